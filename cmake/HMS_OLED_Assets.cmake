@@ -0,0 +1,54 @@
+# HMS_OLED/cmake/HMS_OLED_Assets.cmake
+#
+# hms_oled_add_asset_pack(<target> NAME <symbol> ASSETS a.pbm b.pbm ... [INVERT])
+#   Packs the PBM files with hms_oled_assetpack into <symbol>.h in the build tree and adds it to
+#   <target>'s include path. Relative ASSETS paths are taken from the calling CMakeLists.txt directory.
+#
+# Generic native builds use the hms_oled_assetpack target (HMS_OLED_BUILD_TOOLS). ESP-IDF, Zephyr and
+# other cross builds can't run target binaries, so build the tool once on the host:
+#   cmake -S <HMS_OLED> -B host && cmake --build host --target hms_oled_assetpack
+# and pass -DHMS_OLED_ASSETPACK_EXECUTABLE=<host>/hms_oled_assetpack. Typical targets are
+# ${COMPONENT_LIB} in an ESP-IDF component and app in a Zephyr application. If the library is processed
+# after the caller, include() this file from the project CMakeLists.txt first.
+
+include_guard(GLOBAL)
+
+set(HMS_OLED_ASSETPACK_EXECUTABLE "" CACHE FILEPATH "Host hms_oled_assetpack used by hms_oled_add_asset_pack()")
+
+function(hms_oled_add_asset_pack target)
+    cmake_parse_arguments(ARG "INVERT" "NAME" "ASSETS" ${ARGN})
+    if(NOT ARG_NAME OR NOT ARG_ASSETS)
+        message(FATAL_ERROR "hms_oled_add_asset_pack: NAME and ASSETS are required")
+    endif()
+
+    if(HMS_OLED_ASSETPACK_EXECUTABLE)
+        set(tool ${HMS_OLED_ASSETPACK_EXECUTABLE})
+        set(tool_dep ${HMS_OLED_ASSETPACK_EXECUTABLE})
+    elseif(TARGET hms_oled_assetpack)
+        set(tool hms_oled_assetpack)
+        set(tool_dep hms_oled_assetpack)
+    else()
+        message(FATAL_ERROR "hms_oled_add_asset_pack: set HMS_OLED_ASSETPACK_EXECUTABLE to a host build of hms_oled_assetpack "
+                            "(or enable HMS_OLED_BUILD_TOOLS in a native generic CMake build)")
+    endif()
+
+    set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/hms_oled_assets)
+    set(out ${out_dir}/${ARG_NAME}.h)
+    set(flags)
+    if(ARG_INVERT)
+        list(APPEND flags -i)
+    endif()
+
+    add_custom_command(
+        OUTPUT ${out}
+        COMMAND ${CMAKE_COMMAND} -E make_directory ${out_dir}
+        COMMAND ${tool} -o ${out} -n ${ARG_NAME} ${flags} ${ARG_ASSETS}
+        DEPENDS ${ARG_ASSETS} ${tool_dep}
+        WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
+        COMMENT "Packing HMS_OLED assets ${ARG_NAME}"
+        VERBATIM
+    )
+    add_custom_target(${target}_${ARG_NAME} DEPENDS ${out})
+    add_dependencies(${target} ${target}_${ARG_NAME})
+    target_include_directories(${target} PRIVATE ${out_dir})
+endfunction()
@@ -53,9 +53,19 @@ public:
 
     void freeBuffer(void);
 
+    // Virtual canvas: the buffer may be larger than the panel and display() flushes the viewport window.
+    // Call setCanvasSize() before allocateBuffer(). shareCanvas() tiles another panel's canvas: while any panel
+    // shares it, the owner's setCanvasSize()/allocateBuffer() return HMS_OLED_BUSY and freeBuffer()/deinit() keep
+    // the buffer. Sharers release it with freeBuffer(), and the owner object itself must outlive them.
+    HMS_OLED_StatusTypeDef setCanvasSize(uint16_t width, uint16_t height);
+    HMS_OLED_StatusTypeDef shareCanvas(HMS_OLED* owner);
+    void setViewport(int x, int y);
+
     HMS_OLED_StatusTypeDef hwInit(void);
     void deinit(void);
     HMS_OLED_StatusTypeDef display(void);
+    HMS_OLED_StatusTypeDef displayWindow(int x, int y, int w, int h);
+    HMS_OLED_StatusTypeDef displayDirty(const HMS_OLED_DirtyTypeDef* dirty);
     void clear(void);
 
     void fill(uint8_t pattern);
@@ -71,26 +81,85 @@ public:
     void clearRect(int x, int y, int width, int height);
     void drawLine(int x0, int y0, int x1, int y1, bool color);
     void drawRect(int x, int y, int width, int height, bool color);
+    void drawVLine(int x, int y, int h, bool color);
+    void scrollWindowLeft(int x, int y, int w, int h, int n);
     void drawBitmap(int x, int y, const uint8_t* bitmap, int w, int h);
 
+    // Streaming 8-bit grayscale -> 1bpp, dithered straight into the page buffer one row at a time
+    HMS_OLED_StatusTypeDef beginImage(int x, int y, int w, int h, HMS_OLED_DitherTypeDef mode, uint8_t threshold = 128);
+    HMS_OLED_StatusTypeDef pushImageRows(const uint8_t* gray, int rows = 1, size_t stride = 0);
+    void endImage(void);
+    HMS_OLED_StatusTypeDef drawGrayscale(int x, int y, const uint8_t* gray, int w, int h,
+                                         HMS_OLED_DitherTypeDef mode = HMS_OLED_DITHER_FLOYD_STEINBERG);
+
+    // Compressed asset packs, looked up by id and decoded straight into the page buffer
+    HMS_OLED_StatusTypeDef drawAsset(int x, int y, const uint8_t* pack, size_t len, uint16_t id, bool transparent = false);
+    HMS_OLED_StatusTypeDef getAssetSize(const uint8_t* pack, size_t len, uint16_t id, uint16_t* w, uint16_t* h) const;
+
+    // Key/delta animations decoded in place; y must be page aligned (multiple of 8).
+    // HMS_OLED_ERROR means a bad stream or nothing loaded; a finished one-shot returns OK and stops running.
+    HMS_OLED_StatusTypeDef loadAnimation(const uint8_t* data, size_t len, int x, int y, bool loop = true);
+    HMS_OLED_StatusTypeDef decodeAnimationFrame(HMS_OLED_DirtyTypeDef* dirty);
+    HMS_OLED_StatusTypeDef updateAnimation(void);
+    void setAnimationFps(uint8_t fps);
+    void stopAnimation(void);
+    bool isAnimationRunning() const { return m_anim_data != nullptr; }
+
     uint8_t getDriverType() const { return m_driver_type; }
     uint16_t getWidth() const { return m_width; }
     uint16_t getHeight() const { return m_height; }
+    uint16_t getCanvasWidth() const { return m_canvas_width; }
+    uint16_t getCanvasHeight() const { return m_canvas_height; }
+    int getViewportX() const { return m_view_x; }
+    int getViewportY() const { return m_view_y; }
 
 private:
     HMS_OLED_StatusTypeDef writeCommand(uint8_t cmd);
     HMS_OLED_StatusTypeDef writeCommands(const uint8_t* cmds, size_t len);
     HMS_OLED_StatusTypeDef writeData(const uint8_t* data, size_t len);
+    HMS_OLED_StatusTypeDef writePanelSpan(int page, int col, size_t len);
+    uint32_t getTickMs() const;
     bool detectSH1106();
     size_t calcInternalWidth() const;
+    void ditherRow(const uint8_t* gray);
 
     uint8_t* m_buffer;
     size_t m_buffer_size;
     uint8_t m_driver_type;
     uint16_t m_width;
     uint16_t m_height;
+    uint16_t m_canvas_width;
+    uint16_t m_canvas_height;
+    size_t m_stride;
+    int m_view_x;
+    int m_view_y;
+    bool m_owns_buffer;
+    HMS_OLED* m_canvas_owner;
+    uint8_t m_share_count;
     uint8_t m_i2c_address;
 
+    int m_img_x;
+    int m_img_y;
+    int m_img_w;
+    int m_img_h;
+    int m_img_row;
+    uint8_t m_img_threshold;
+    HMS_OLED_DitherTypeDef m_img_mode;
+    int16_t* m_img_error;
+
+    const uint8_t* m_anim_data;
+    size_t m_anim_len;
+    size_t m_anim_pos;
+    uint16_t m_anim_frame;
+    uint16_t m_anim_frames;
+    uint16_t m_anim_width;
+    uint16_t m_anim_height;
+    int m_anim_x;
+    int m_anim_page;
+    bool m_anim_loop;
+    uint32_t m_anim_interval_ms;
+    uint32_t m_anim_last_ms;
+
     #if defined(HMS_OLED_PLATFORM_ARDUINO)
     TwoWire *m_wire;
     #elif defined(HMS_OLED_PLATFORM_ESP_IDF)
@@ -0,0 +1,90 @@
+/*
+ ============================================================================================================================================
+ * File:        HMS_OLED_Chart.h
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.0.0
+ * Date:        Oct 18 2026
+ * Brief:       This file package provides a scrolling time-series chart widget for HMS_OLED.
+ ============================================================================================================================================
+ * License: 
+ * MIT License
+ * 
+ * Copyright (c) 2025 Hamas Saeed
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, 
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do 
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION 
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ ============================================================================================================================================
+ */
+
+#ifndef HMS_OLED_CHART_H
+#define HMS_OLED_CHART_H
+
+#include "HMS_OLED.h"
+
+#ifndef HMS_OLED_CHART_MAX_SERIES
+    #define HMS_OLED_CHART_MAX_SERIES           4
+#endif
+
+/*
+ * Samples live in a fixed ring buffer of w * k + 1 samples per series, where k = ceil(capacity / w) samples
+ * are folded into one pixel column as a min/max span. A new sample only redraws its own column; starting
+ * a new column shifts the plot window left by one. Autoscale works from per-column min/max, so rescaling
+ * costs O(w) rather than O(capacity), and full redraws happen only when the scale changes.
+ */
+class HMS_OLED_Chart {
+public:
+    HMS_OLED_Chart();
+    ~HMS_OLED_Chart();
+
+    HMS_OLED_StatusTypeDef begin(HMS_OLED* oled, int x, int y, int w, int h, uint8_t series = 1, uint16_t capacity = 0);
+    void end(void);
+
+    void setRange(float min, float max);
+    void setAutoScale(bool enable);
+
+    HMS_OLED_StatusTypeDef addSample(float value);
+    HMS_OLED_StatusTypeDef addSample(const float* values);
+    void clear(void);
+    void redraw(void);
+
+    HMS_OLED_StatusTypeDef display(void);
+
+    float getMin() const { return m_lo; }
+    float getMax() const { return m_hi; }
+    uint16_t getSamplesPerColumn() const { return m_per_column; }
+
+private:
+    float sampleAt(uint8_t s, uint32_t index) const;
+    int valueToY(float v) const;
+    bool updateScale(bool full_check, const float* values);
+    void drawColumn(uint32_t group, int col);
+
+    HMS_OLED* m_oled;
+    float* m_samples;
+    float* m_col_lo;
+    float* m_col_hi;
+    int m_x;
+    int m_y;
+    int m_w;
+    int m_h;
+    uint8_t m_series;
+    uint16_t m_per_column;
+    uint32_t m_capacity;
+    uint32_t m_total;
+    float m_lo;
+    float m_hi;
+    bool m_autoscale;
+};
+
+#endif // HMS_OLED_CHART_H
@@ -71,6 +71,14 @@
     #define HMS_OLED_PLATFORM_STM32_HAL
 #elif defined(__linux__) || defined(_WIN32) || defined(__APPLE__)
     // Desktop specific includes
+    #include <cstdio>
+    #include <cstring>
+    #include <cstdlib>
+    #include <stdint.h>
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #include <emmintrin.h>
+        #define HMS_OLED_SIMD_SSE2
+    #endif
     #define HMS_OLED_PLATFORM_DESKTOP
 #endif // Platform detection
 
@@ -121,6 +129,10 @@
 #define HMS_OLED_DEFAULT_WIDTH                  128
 #define HMS_OLED_DEFAULT_HEIGHT                 64
 
+#define HMS_OLED_SSD1306_RAM_WIDTH              128                          // Controller RAM columns per page
+#define HMS_OLED_SH1106_RAM_WIDTH               132
+#define HMS_OLED_MAX_RAM_WIDTH                  HMS_OLED_SH1106_RAM_WIDTH
+
 #define HMS_OLED_DEFAULT_SCL                    12
 #define HMS_OLED_DEFAULT_SDA                    13
 #if defined(HMS_OLED_PLATFORM_ESP_IDF)
@@ -130,6 +142,57 @@
 #endif
 #define HMS_OLED_DEFAULT_FREQ_HZ                400000
 
+#ifndef HMS_OLED_MAX_CANVAS_HEIGHT
+    #define HMS_OLED_MAX_CANVAS_HEIGHT          256                          // Tallest virtual canvas, sizes dirty tracking
+#endif
+#define HMS_OLED_MAX_PAGES                      (HMS_OLED_MAX_CANVAS_HEIGHT / 8)
+
+/*
+  ┌─────────────────────────────────────────────────────────────────────┐
+  │ Note: Packed page-format stream (animations and assets)             │
+  │  0x00-0x3F  skip n+1 bytes                                          │
+  │  0x40-0x7F  next byte repeated n+1 times                            │
+  │  0x80-0xFF  n+1 literal bytes follow                                │
+  │ Bytes are page-major: page 0 columns 0..w-1, then page 1, ...       │
+  └─────────────────────────────────────────────────────────────────────┘
+*/
+#define HMS_OLED_PACKET_SKIP                    0x00
+#define HMS_OLED_PACKET_RUN                     0x40
+#define HMS_OLED_PACKET_LITERAL                 0x80
+#define HMS_OLED_PACKET_MAX_SKIP                64
+#define HMS_OLED_PACKET_MAX_RUN                 64
+#define HMS_OLED_PACKET_MAX_LITERAL             128
+
+/*
+  ┌─────────────────────────────────────────────────────────────────────┐
+  │ Note: Animation container                                           │
+  │  Header: 'H' 'A' width(u16) height(u16) fps(u8) frames(u16)         │
+  │  Frame:  type(u8) length(u16) packed stream                         │
+  │  Key frames write bytes (skips become 0), delta frames XOR them.    │
+  │  Multi-byte fields are little endian.                               │
+  └─────────────────────────────────────────────────────────────────────┘
+*/
+#define HMS_OLED_ANIM_MAGIC_0                   'H'
+#define HMS_OLED_ANIM_MAGIC_1                   'A'
+#define HMS_OLED_ANIM_HEADER_SIZE               9
+#define HMS_OLED_ANIM_FRAME_HEADER_SIZE         3
+#define HMS_OLED_ANIM_FRAME_KEY                 0x00
+#define HMS_OLED_ANIM_FRAME_DELTA               0x01
+
+/*
+  ┌─────────────────────────────────────────────────────────────────────┐
+  │ Note: Asset pack                                                    │
+  │  Header: 'H' 'P' count(u16)                                         │
+  │  Index:  count x { offset(u32) width(u16) height(u16) }             │
+  │  Data:   one packed stream per asset, skips are blank bytes         │
+  │  Offsets are from the start of the pack, little endian.             │
+  └─────────────────────────────────────────────────────────────────────┘
+*/
+#define HMS_OLED_PACK_MAGIC_0                   'H'
+#define HMS_OLED_PACK_MAGIC_1                   'P'
+#define HMS_OLED_PACK_HEADER_SIZE               4
+#define HMS_OLED_PACK_ENTRY_SIZE                8
+
 #define HMS_OLED_ALL_FONTS
 #define HMS_OLED_SMALL_FONT
 
@@ -142,6 +205,17 @@ typedef enum {
     HMS_OLED_NO_MEM   = 0x05
 } HMS_OLED_StatusTypeDef;
 
+typedef enum {
+    HMS_OLED_DITHER_THRESHOLD       = 0x00,     // Plain threshold compare
+    HMS_OLED_DITHER_BAYER           = 0x01,     // Ordered 8x8 Bayer matrix
+    HMS_OLED_DITHER_FLOYD_STEINBERG = 0x02      // Error diffusion with a single row error buffer
+} HMS_OLED_DitherTypeDef;
+
+typedef struct {
+    uint16_t col_start[HMS_OLED_MAX_PAGES];     // First changed column per page
+    uint16_t col_end[HMS_OLED_MAX_PAGES];       // One past the last changed column (page is clean when start >= end)
+} HMS_OLED_DirtyTypeDef;
+
 typedef enum {
     OLED_DRIVER_TYPE_SH1106  = 1,
     OLED_DRIVER_TYPE_SSD1306 = 0
@@ -1,17 +1,104 @@
 #include "HMS_OLED.h"
 #include <cstring>
 
+#if defined(HMS_OLED_PLATFORM_DESKTOP)
+    #include <chrono>
+#endif
+
 #if HMS_OLED_DEBUG_ENABLED
     ChronoLogger *oledLogger = nullptr;
 #endif
 
+// 8x8 Bayer matrix pre-scaled to 0..255 thresholds (pixel is lit when gray >= value)
+static const uint8_t bayer_8x8[8][8] = {
+    {  3, 131,  35, 163,  11, 139,  43, 171},
+    {195,  67, 227,  99, 203,  75, 235, 107},
+    { 51, 179,  19, 147,  59, 187,  27, 155},
+    {243, 115, 211,  83, 251, 123, 219,  91},
+    { 15, 143,  47, 175,   7, 135,  39, 167},
+    {207,  79, 239, 111, 199,  71, 231, 103},
+    { 63, 191,  31, 159,  55, 183,  23, 151},
+    {255, 127, 223,  95, 247, 119, 215,  87}
+};
+
+/*
+ * Walks a packed page-format stream (see HMS_OLED_Config.h) covering `total` bytes and calls
+ * put(pos, value) for every run/literal byte. Skipped bytes are reported as zero only when
+ * fill_skips is set. Returns false on a truncated or overlong stream.
+ */
+template <typename Fn>
+static bool decodePackets(const uint8_t* src, size_t len, size_t total, bool fill_skips, Fn&& put) {
+    size_t in = 0;
+    size_t out = 0;
+    while (out < total) {
+        if (in >= len) return false;
+        uint8_t ctrl = src[in++];
+
+        if (ctrl & HMS_OLED_PACKET_LITERAL) {
+            size_t n = (ctrl & 0x7F) + 1;
+            if (out + n > total || in + n > len) return false;
+            for (size_t i = 0; i < n; i++) put(out + i, src[in + i]);
+            in += n;
+            out += n;
+        } else if (ctrl & HMS_OLED_PACKET_RUN) {
+            size_t n = (ctrl & 0x3F) + 1;
+            if (out + n > total || in >= len) return false;
+            uint8_t v = src[in++];
+            for (size_t i = 0; i < n; i++) put(out + i, v);
+            out += n;
+        } else {
+            size_t n = (ctrl & 0x3F) + 1;
+            if (out + n > total) return false;
+            if (fill_skips) {
+                for (size_t i = 0; i < n; i++) put(out + i, 0);
+            }
+            out += n;
+        }
+    }
+    return true;
+}
+
+static inline void markDirty(HMS_OLED_DirtyTypeDef* dirty, int page, int col) {
+    if (!dirty || page >= HMS_OLED_MAX_PAGES) return;
+    if (col < dirty->col_start[page]) dirty->col_start[page] = (uint16_t)col;
+    if (col + 1 > dirty->col_end[page]) dirty->col_end[page] = (uint16_t)(col + 1);
+}
+
 HMS_OLED::HMS_OLED() : 
     m_buffer(nullptr), 
     m_buffer_size(0), 
     m_driver_type(OLED_DRIVER_TYPE_SSD1306), 
     m_width(HMS_OLED_DEFAULT_WIDTH), 
     m_height(HMS_OLED_DEFAULT_HEIGHT),
-    m_i2c_address(HMS_OLED_DEFAULT_ADDRESS)
+    m_canvas_width(HMS_OLED_DEFAULT_WIDTH),
+    m_canvas_height(HMS_OLED_DEFAULT_HEIGHT),
+    m_stride(0),
+    m_view_x(0),
+    m_view_y(0),
+    m_owns_buffer(true),
+    m_canvas_owner(nullptr),
+    m_share_count(0),
+    m_i2c_address(HMS_OLED_DEFAULT_ADDRESS),
+    m_img_x(0),
+    m_img_y(0),
+    m_img_w(0),
+    m_img_h(0),
+    m_img_row(0),
+    m_img_threshold(128),
+    m_img_mode(HMS_OLED_DITHER_THRESHOLD),
+    m_img_error(nullptr),
+    m_anim_data(nullptr),
+    m_anim_len(0),
+    m_anim_pos(0),
+    m_anim_frame(0),
+    m_anim_frames(0),
+    m_anim_width(0),
+    m_anim_height(0),
+    m_anim_x(0),
+    m_anim_page(0),
+    m_anim_loop(false),
+    m_anim_interval_ms(0),
+    m_anim_last_ms(0)
     #if defined(HMS_OLED_PLATFORM_ARDUINO)
     , m_wire(nullptr)
     #elif defined(HMS_OLED_PLATFORM_ESP_IDF)
@@ -25,11 +112,14 @@ HMS_OLED::HMS_OLED() :
 }
 
 HMS_OLED::~HMS_OLED() {
+    stopAnimation();
+    endImage();
+    m_share_count = 0;
     freeBuffer();
 }
 
 size_t HMS_OLED::calcInternalWidth() const {
-    return (m_driver_type == OLED_DRIVER_TYPE_SH1106) ? 132 : 128;
+    return (m_driver_type == OLED_DRIVER_TYPE_SH1106) ? HMS_OLED_SH1106_RAM_WIDTH : HMS_OLED_SSD1306_RAM_WIDTH;
 }
 
 #if defined(HMS_OLED_PLATFORM_ARDUINO)
@@ -155,6 +245,59 @@ HMS_OLED_StatusTypeDef HMS_OLED::writeData(const uint8_t* data, size_t len) {
     #endif
 }
 
+HMS_OLED_StatusTypeDef HMS_OLED::writePanelSpan(int page, int col, size_t len) {
+    if (col < 0 || col + len > calcInternalWidth()) return HMS_OLED_ERROR;
+
+    uint8_t cmds[] = {
+        (uint8_t)(0xB0 + page),             // page addr
+        (uint8_t)(0x00 | (col & 0x0F)),     // lower col start
+        (uint8_t)(0x10 | (col >> 4))        // higher col start
+    };
+    HMS_OLED_StatusTypeDef r = writeCommands(cmds, sizeof(cmds));
+    if (r != HMS_OLED_OK) return r;
+
+    size_t src_col = m_view_x + col;
+    int src_page = m_view_y / 8 + page;
+    int shift = m_view_y & 7;
+
+    // Page aligned viewport inside the buffer row: send straight from the canvas
+    if (shift == 0 && src_col + len <= m_stride) {
+        return writeData(&m_buffer[src_page * m_stride + src_col], len);
+    }
+
+    // Otherwise stitch each panel byte from the two canvas pages it straddles
+    uint8_t row[HMS_OLED_MAX_RAM_WIDTH];
+    int canvas_pages = m_canvas_height / 8;
+    for (size_t i = 0; i < len; i++) {
+        size_t c = src_col + i;
+        if (c >= m_stride) {
+            row[i] = 0;
+            continue;
+        }
+        uint8_t lo = m_buffer[src_page * m_stride + c] >> shift;
+        uint8_t hi = (shift && src_page + 1 < canvas_pages) ? (uint8_t)(m_buffer[(src_page + 1) * m_stride + c] << (8 - shift)) : 0;
+        row[i] = lo | hi;
+    }
+    return writeData(row, len);
+}
+
+uint32_t HMS_OLED::getTickMs() const {
+    #if defined(HMS_OLED_PLATFORM_ARDUINO)
+        return millis();
+    #elif defined(HMS_OLED_PLATFORM_ESP_IDF)
+        return (uint32_t)(xTaskGetTickCount() * portTICK_PERIOD_MS);
+    #elif defined(HMS_OLED_PLATFORM_ZEPHYR)
+        return k_uptime_get_32();
+    #elif defined(HMS_OLED_PLATFORM_STM32_HAL)
+        return HAL_GetTick();
+    #elif defined(HMS_OLED_PLATFORM_DESKTOP)
+        return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    #else
+        return 0;
+    #endif
+}
+
 bool HMS_OLED::detectSH1106() {
     HMS_OLED_StatusTypeDef r = writeCommand(0xB0 + 7);
     return (r == HMS_OLED_OK);
@@ -171,30 +314,86 @@ void HMS_OLED::detectDriver(void) {
 }
 
 HMS_OLED_StatusTypeDef HMS_OLED::allocateBuffer(void) {
+    if (m_share_count > 0) return HMS_OLED_BUSY;
     freeBuffer();
 
+    // Rows are at least as wide as the controller RAM so a 1:1 canvas can be flushed in place
     size_t internal_w = calcInternalWidth();
-    m_buffer_size = (internal_w * m_height) / 8;
+    m_stride = (m_canvas_width > internal_w) ? m_canvas_width : internal_w;
+    m_buffer_size = (m_stride * m_canvas_height) / 8;
     m_buffer = (uint8_t*) malloc(m_buffer_size);
     if (!m_buffer) {
         HMS_OLED_LOGGER(error, "Failed to allocate oled buffer (%d bytes)", (int)m_buffer_size);
         m_buffer_size = 0;
+        m_stride = 0;
         return HMS_OLED_NO_MEM;
     }
+    m_owns_buffer = true;
     memset(m_buffer, 0, m_buffer_size);
-    HMS_OLED_LOGGER(info, "OLED buffer allocated %d bytes (internal width=%d height=%d)",
-             (int)m_buffer_size, (int)internal_w, (int)m_height);
+    HMS_OLED_LOGGER(info, "OLED buffer allocated %d bytes (stride=%d height=%d)",
+             (int)m_buffer_size, (int)m_stride, (int)m_canvas_height);
     return HMS_OLED_OK;
 }
 
 void HMS_OLED::freeBuffer(void) {
+    if (m_share_count > 0) {
+        HMS_OLED_LOGGER(error, "Canvas still shared by %d panel(s), keeping buffer", (int)m_share_count);
+        return;
+    }
     if (m_buffer) {
-        free(m_buffer);
+        if (m_owns_buffer)
+            free(m_buffer);
+        else if (m_canvas_owner)
+            m_canvas_owner->m_share_count--;
+        m_canvas_owner = nullptr;
         m_buffer = nullptr;
         m_buffer_size = 0;
+        m_stride = 0;
+        m_owns_buffer = true;
     }
 }
 
+HMS_OLED_StatusTypeDef HMS_OLED::setCanvasSize(uint16_t width, uint16_t height) {
+    if (width < m_width || height < m_height) return HMS_OLED_ERROR;
+    if (height % 8 != 0 || height / 8 > HMS_OLED_MAX_PAGES) return HMS_OLED_ERROR;
+    if (m_buffer && !m_owns_buffer) return HMS_OLED_ERROR;
+    if (m_share_count > 0) return HMS_OLED_BUSY;
+
+    m_canvas_width = width;
+    m_canvas_height = height;
+    setViewport(m_view_x, m_view_y);
+
+    if (m_buffer) return allocateBuffer();
+    return HMS_OLED_OK;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::shareCanvas(HMS_OLED* owner) {
+    if (owner && !owner->m_owns_buffer) owner = owner->m_canvas_owner;
+    if (!owner || owner == this || !owner->m_buffer) return HMS_OLED_ERROR;
+    if (m_share_count > 0) return HMS_OLED_BUSY;
+    if (owner->m_canvas_width < m_width || owner->m_canvas_height < m_height) return HMS_OLED_ERROR;
+    if (owner->m_share_count == 0xFF) return HMS_OLED_BUSY;
+
+    freeBuffer();
+    owner->m_share_count++;
+    m_canvas_owner = owner;
+    m_buffer = owner->m_buffer;
+    m_buffer_size = owner->m_buffer_size;
+    m_stride = owner->m_stride;
+    m_canvas_width = owner->m_canvas_width;
+    m_canvas_height = owner->m_canvas_height;
+    m_owns_buffer = false;
+    setViewport(m_view_x, m_view_y);
+    return HMS_OLED_OK;
+}
+
+void HMS_OLED::setViewport(int x, int y) {
+    int max_x = m_canvas_width - m_width;
+    int max_y = m_canvas_height - m_height;
+    m_view_x = (x < 0) ? 0 : (x > max_x) ? max_x : x;
+    m_view_y = (y < 0) ? 0 : (y > max_y) ? max_y : y;
+}
+
 HMS_OLED_StatusTypeDef HMS_OLED::hwInit(void) {
     const uint8_t init_seq[] = {
         0xAE,       // display off
@@ -235,11 +434,10 @@ void HMS_OLED::fill(uint8_t pattern) {
 
 void HMS_OLED::setPixel(int x, int y, bool color) {
     if (!m_buffer) return;
-    if (x < 0 || x >= m_width) return;
-    if (y < 0 || y >= m_height) return;
+    if (x < 0 || x >= m_canvas_width) return;
+    if (y < 0 || y >= m_canvas_height) return;
 
-    size_t internal_w = calcInternalWidth();
-    size_t byte_index = x + (y / 8) * internal_w;
+    size_t byte_index = x + (y / 8) * m_stride;
 
     if (byte_index >= m_buffer_size) return;
 
@@ -283,9 +481,7 @@ void HMS_OLED::drawFloat(int x, int y, float value, int decimals) {
 
 void HMS_OLED::clearRect(int x, int y, int width, int height) {
     for (int i = x; i < x + width; i++) {
-        for (int j = y; j < y + height; j++) {
-            setPixel(i, j, false);
-        }
+        drawVLine(i, y, height, false);
     }
 }
 
@@ -310,6 +506,60 @@ void HMS_OLED::drawRect(int x, int y, int width, int height, bool color) {
     drawLine(x + width - 1, y, x + width - 1, y + height - 1, color);
 }
 
+void HMS_OLED::drawVLine(int x, int y, int h, bool color) {
+    if (!m_buffer) return;
+    if (x < 0 || x >= m_canvas_width) return;
+
+    int y0 = (y < 0) ? 0 : y;
+    int y1 = (y + h > m_canvas_height) ? m_canvas_height : y + h;
+    if (y1 <= y0) return;
+
+    size_t stride = m_stride;
+    for (int p = y0 / 8; p <= (y1 - 1) / 8; p++) {
+        int top = (p * 8 > y0) ? p * 8 : y0;
+        int bottom = (p * 8 + 8 < y1) ? p * 8 + 8 : y1;
+        uint8_t mask = (uint8_t)((0xFF << (top & 7)) & (0xFF >> (8 - (bottom - p * 8))));
+
+        uint8_t* dst = &m_buffer[p * stride + x];
+        if (color)
+            *dst |= mask;
+        else
+            *dst &= ~mask;
+    }
+}
+
+void HMS_OLED::scrollWindowLeft(int x, int y, int w, int h, int n) {
+    if (!m_buffer || n <= 0) return;
+
+    int x0 = (x < 0) ? 0 : x;
+    int y0 = (y < 0) ? 0 : y;
+    int x1 = (x + w > m_canvas_width) ? m_canvas_width : x + w;
+    int y1 = (y + h > m_canvas_height) ? m_canvas_height : y + h;
+    if (x1 <= x0 || y1 <= y0) return;
+
+    int span = x1 - x0;
+    int keep = (n < span) ? span - n : 0;
+    size_t stride = m_stride;
+
+    for (int p = y0 / 8; p <= (y1 - 1) / 8; p++) {
+        int top = (p * 8 > y0) ? p * 8 : y0;
+        int bottom = (p * 8 + 8 < y1) ? p * 8 + 8 : y1;
+        uint8_t mask = (uint8_t)((0xFF << (top & 7)) & (0xFF >> (8 - (bottom - p * 8))));
+        uint8_t* row = &m_buffer[p * stride + x0];
+
+        if (mask == 0xFF) {
+            // Whole page row belongs to the window: plain byte move
+            memmove(row, row + n, keep);
+            memset(row + keep, 0, span - keep);
+        } else {
+            for (int c = 0; c < keep; c++)
+                row[c] = (row[c] & ~mask) | (row[c + n] & mask);
+            for (int c = keep; c < span; c++)
+                row[c] &= ~mask;
+        }
+    }
+}
+
 void HMS_OLED::drawBitmap(int x, int y, const uint8_t* bitmap, int w, int h) {
     if (!bitmap) return;
     int bytes_per_row = (w + 7) / 8;
@@ -324,6 +574,131 @@ void HMS_OLED::drawBitmap(int x, int y, const uint8_t* bitmap, int w, int h) {
     }
 }
 
+HMS_OLED_StatusTypeDef HMS_OLED::beginImage(int x, int y, int w, int h, HMS_OLED_DitherTypeDef mode, uint8_t threshold) {
+    endImage();
+    if (!m_buffer) return HMS_OLED_ERROR;
+    if (w <= 0 || h <= 0) return HMS_OLED_ERROR;
+
+    if (mode == HMS_OLED_DITHER_FLOYD_STEINBERG) {
+        m_img_error = (int16_t*) malloc(w * sizeof(int16_t));
+        if (!m_img_error) {
+            HMS_OLED_LOGGER(error, "Failed to allocate dither row (%d bytes)", (int)(w * sizeof(int16_t)));
+            return HMS_OLED_NO_MEM;
+        }
+        memset(m_img_error, 0, w * sizeof(int16_t));
+    }
+
+    m_img_x = x;
+    m_img_y = y;
+    m_img_w = w;
+    m_img_h = h;
+    m_img_row = 0;
+    m_img_mode = mode;
+    m_img_threshold = threshold;
+    return HMS_OLED_OK;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::pushImageRows(const uint8_t* gray, int rows, size_t stride) {
+    if (!gray || m_img_w == 0) return HMS_OLED_ERROR;
+    if (stride == 0) stride = m_img_w;
+
+    for (int r = 0; r < rows; r++) {
+        if (m_img_row >= m_img_h) return HMS_OLED_ERROR;
+        ditherRow(gray + r * stride);
+        m_img_row++;
+    }
+
+    // Release the error row as soon as the last row is in
+    if (m_img_row >= m_img_h) endImage();
+    return HMS_OLED_OK;
+}
+
+void HMS_OLED::endImage(void) {
+    if (m_img_error) {
+        free(m_img_error);
+        m_img_error = nullptr;
+    }
+    m_img_w = 0;
+    m_img_h = 0;
+    m_img_row = 0;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::drawGrayscale(int x, int y, const uint8_t* gray, int w, int h, HMS_OLED_DitherTypeDef mode) {
+    if (!gray) return HMS_OLED_ERROR;
+    HMS_OLED_StatusTypeDef r = beginImage(x, y, w, h, mode);
+    if (r != HMS_OLED_OK) return r;
+    return pushImageRows(gray, h, w);
+}
+
+void HMS_OLED::ditherRow(const uint8_t* gray) {
+    int y = m_img_y + m_img_row;
+    bool visible = m_buffer && y >= 0 && y < m_canvas_height;
+
+    // Visible column range of this row, relative to the image
+    int c0 = (m_img_x < 0) ? -m_img_x : 0;
+    int c1 = (m_img_x + m_img_w > m_canvas_width) ? m_canvas_width - m_img_x : m_img_w;
+    if (c1 <= c0) visible = false;
+
+    // dst[0] is the first visible column (image column c0)
+    uint8_t* dst = nullptr;
+    uint8_t bit = (uint8_t)(1 << (y & 7));
+    if (visible) dst = m_buffer + (y / 8) * m_stride + (m_img_x + c0);
+
+    if (m_img_mode == HMS_OLED_DITHER_FLOYD_STEINBERG) {
+        // Error has to propagate through clipped columns too, so walk the full row
+        int16_t* err = m_img_error;
+        int carry = 0;
+        int next_prev = 0;
+        int next_cur = 0;
+        for (int c = 0; c < m_img_w; c++) {
+            int v = gray[c] + err[c] + carry;
+            bool on = v >= m_img_threshold;
+            int e = on ? v - 255 : v;
+
+            if (visible && c >= c0 && c < c1)
+                dst[c - c0] = (dst[c - c0] & ~bit) | (on ? bit : 0);
+
+            int e7 = (e * 7) / 16;
+            int e3 = (e * 3) / 16;
+            int e5 = (e * 5) / 16;
+            carry = e7;
+            next_prev += e3;
+            if (c > 0) err[c - 1] = (int16_t)next_prev;
+            next_prev = next_cur + e5;
+            next_cur = e - e7 - e3 - e5;
+        }
+        err[m_img_w - 1] = (int16_t)next_prev;
+        return;
+    }
+
+    if (!visible) return;
+
+    // Threshold and Bayer are stateless per pixel, so only the visible span is touched
+    uint8_t thresholds[16];
+    const uint8_t* bayer_row = bayer_8x8[y & 7];
+    for (int k = 0; k < 16; k++) {
+        thresholds[k] = (m_img_mode == HMS_OLED_DITHER_BAYER) ? bayer_row[(m_img_x + c0 + k) & 7] : m_img_threshold;
+    }
+
+    int c = c0;
+    #if defined(HMS_OLED_SIMD_SSE2)
+        // 16 columns per step: unsigned gray >= threshold, then merge the row bit into the page bytes
+        __m128i vt = _mm_loadu_si128((const __m128i*)thresholds);
+        __m128i vbit = _mm_set1_epi8((char)bit);
+        for (; c + 16 <= c1; c += 16) {
+            __m128i g = _mm_loadu_si128((const __m128i*)(gray + c));
+            __m128i on = _mm_cmpeq_epi8(_mm_max_epu8(g, vt), g);
+            __m128i d = _mm_loadu_si128((const __m128i*)(dst + (c - c0)));
+            d = _mm_or_si128(_mm_andnot_si128(vbit, d), _mm_and_si128(on, vbit));
+            _mm_storeu_si128((__m128i*)(dst + (c - c0)), d);
+        }
+    #endif
+    for (; c < c1; c++) {
+        bool on = gray[c] >= thresholds[(c - c0) & 15];
+        dst[c - c0] = (dst[c - c0] & ~bit) | (on ? bit : 0);
+    }
+}
+
 HMS_OLED_StatusTypeDef HMS_OLED::display(void) {
     if (!m_buffer) return HMS_OLED_ERROR;
 
@@ -332,16 +707,224 @@ HMS_OLED_StatusTypeDef HMS_OLED::display(void) {
     int pages = m_height / 8;
 
     for (int p = 0; p < pages; p++) {
-        uint8_t cmds[] = {
-            (uint8_t)(0xB0 + p),      // page addr
-            0x00,                     // lower col start
-            0x10                      // higher col start
-        };
-        r = writeCommands(cmds, sizeof(cmds));
+        r = writePanelSpan(p, 0, internal_w);
+        if (r != HMS_OLED_OK) return r;
+    }
+    return r;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::displayWindow(int x, int y, int w, int h) {
+    if (!m_buffer) return HMS_OLED_ERROR;
+
+    // Canvas rectangle clipped to the viewport, then moved into panel coordinates
+    int x0 = (x > m_view_x) ? x : m_view_x;
+    int y0 = (y > m_view_y) ? y : m_view_y;
+    int x1 = (x + w < m_view_x + m_width) ? x + w : m_view_x + m_width;
+    int y1 = (y + h < m_view_y + m_height) ? y + h : m_view_y + m_height;
+    if (x1 <= x0 || y1 <= y0) return HMS_OLED_OK;
+
+    x0 -= m_view_x;
+    x1 -= m_view_x;
+    y0 -= m_view_y;
+    y1 -= m_view_y;
+
+    HMS_OLED_StatusTypeDef r = HMS_OLED_OK;
+    for (int p = y0 / 8; p <= (y1 - 1) / 8; p++) {
+        r = writePanelSpan(p, x0, x1 - x0);
         if (r != HMS_OLED_OK) return r;
+    }
+    return r;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::displayDirty(const HMS_OLED_DirtyTypeDef* dirty) {
+    if (!m_buffer || !dirty) return HMS_OLED_ERROR;
+
+    HMS_OLED_StatusTypeDef r = HMS_OLED_OK;
+    int pages = m_height / 8;
+    int canvas_pages = m_canvas_height / 8;
+    if (canvas_pages > HMS_OLED_MAX_PAGES) canvas_pages = HMS_OLED_MAX_PAGES;
+
+    for (int p = 0; p < pages; p++) {
+        // A panel page covers one canvas page, or two when the viewport isn't page aligned
+        int first = (m_view_y + p * 8) / 8;
+        int last = (m_view_y + p * 8 + 7) / 8;
+        int start = m_view_x + m_width;
+        int end = m_view_x;
+        for (int cp = first; cp <= last && cp < canvas_pages; cp++) {
+            if (dirty->col_start[cp] >= dirty->col_end[cp]) continue;
+            if (dirty->col_start[cp] < start) start = dirty->col_start[cp];
+            if (dirty->col_end[cp] > end) end = dirty->col_end[cp];
+        }
+
+        if (start < m_view_x) start = m_view_x;
+        if (end > m_view_x + m_width) end = m_view_x + m_width;
+        if (end <= start) continue;
 
-        r = writeData(&m_buffer[p * internal_w], internal_w);
+        r = writePanelSpan(p, start - m_view_x, end - start);
         if (r != HMS_OLED_OK) return r;
     }
     return r;
 }
+
+HMS_OLED_StatusTypeDef HMS_OLED::getAssetSize(const uint8_t* pack, size_t len, uint16_t id, uint16_t* w, uint16_t* h) const {
+    if (!pack || len < HMS_OLED_PACK_HEADER_SIZE) return HMS_OLED_ERROR;
+    if (pack[0] != HMS_OLED_PACK_MAGIC_0 || pack[1] != HMS_OLED_PACK_MAGIC_1) return HMS_OLED_ERROR;
+
+    uint16_t count = (uint16_t)(pack[2] | (pack[3] << 8));
+    if (id >= count) return HMS_OLED_NOT_FOUND;
+
+    size_t entry = HMS_OLED_PACK_HEADER_SIZE + (size_t)id * HMS_OLED_PACK_ENTRY_SIZE;
+    if (entry + HMS_OLED_PACK_ENTRY_SIZE > len) return HMS_OLED_ERROR;
+
+    if (w) *w = (uint16_t)(pack[entry + 4] | (pack[entry + 5] << 8));
+    if (h) *h = (uint16_t)(pack[entry + 6] | (pack[entry + 7] << 8));
+    return HMS_OLED_OK;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::drawAsset(int x, int y, const uint8_t* pack, size_t len, uint16_t id, bool transparent) {
+    if (!m_buffer) return HMS_OLED_ERROR;
+
+    uint16_t w, h;
+    HMS_OLED_StatusTypeDef r = getAssetSize(pack, len, id, &w, &h);
+    if (r != HMS_OLED_OK) return r;
+    if (w == 0 || h == 0) return HMS_OLED_OK;
+
+    const uint8_t* entry = pack + HMS_OLED_PACK_HEADER_SIZE + (size_t)id * HMS_OLED_PACK_ENTRY_SIZE;
+    size_t offset = (size_t)entry[0] | ((size_t)entry[1] << 8) | ((size_t)entry[2] << 16) | ((size_t)entry[3] << 24);
+    if (offset >= len) return HMS_OLED_ERROR;
+
+    size_t stride = m_stride;
+    int canvas_pages = m_canvas_height / 8;
+    int pages = (h + 7) / 8;
+    uint8_t last_mask = (h & 7) ? (uint8_t)((1 << (h & 7)) - 1) : 0xFF;
+
+    // Asset page p straddles buffer pages base + p and base + p + 1 when y isn't page aligned
+    int base = (y >= 0) ? y / 8 : -((7 - y) / 8);
+    int shift = y - base * 8;
+
+    bool ok = decodePackets(pack + offset, len - offset, (size_t)w * pages, !transparent,
+        [&](size_t pos, uint8_t v) {
+            int p = (int)(pos / w);
+            int col = x + (int)(pos % w);
+            if (col < 0 || col >= m_canvas_width) return;
+
+            uint8_t m = (p == pages - 1) ? last_mask : 0xFF;
+            v &= m;
+
+            int page = base + p;
+            if (page >= 0 && page < canvas_pages) {
+                uint8_t* dst = &m_buffer[page * stride + col];
+                uint8_t mask = (uint8_t)(m << shift);
+                *dst = transparent ? (uint8_t)(*dst | (v << shift)) : (uint8_t)((*dst & ~mask) | (v << shift));
+            }
+            if (shift && page + 1 >= 0 && page + 1 < canvas_pages) {
+                uint8_t* dst = &m_buffer[(page + 1) * stride + col];
+                uint8_t mask = (uint8_t)(m >> (8 - shift));
+                *dst = transparent ? (uint8_t)(*dst | (v >> (8 - shift))) : (uint8_t)((*dst & ~mask) | (v >> (8 - shift)));
+            }
+        });
+    return ok ? HMS_OLED_OK : HMS_OLED_ERROR;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::loadAnimation(const uint8_t* data, size_t len, int x, int y, bool loop) {
+    stopAnimation();
+    if (!data || len < HMS_OLED_ANIM_HEADER_SIZE) return HMS_OLED_ERROR;
+    if (data[0] != HMS_OLED_ANIM_MAGIC_0 || data[1] != HMS_OLED_ANIM_MAGIC_1) return HMS_OLED_ERROR;
+    if (y % 8 != 0) return HMS_OLED_ERROR;
+
+    m_anim_width = (uint16_t)(data[2] | (data[3] << 8));
+    m_anim_height = (uint16_t)(data[4] | (data[5] << 8));
+    m_anim_frames = (uint16_t)(data[7] | (data[8] << 8));
+    if (m_anim_width == 0 || m_anim_height == 0 || m_anim_frames == 0) return HMS_OLED_ERROR;
+
+    m_anim_data = data;
+    m_anim_len = len;
+    m_anim_pos = HMS_OLED_ANIM_HEADER_SIZE;
+    m_anim_frame = 0;
+    m_anim_x = x;
+    m_anim_page = y / 8;
+    m_anim_loop = loop;
+    setAnimationFps(data[6]);
+    return HMS_OLED_OK;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::decodeAnimationFrame(HMS_OLED_DirtyTypeDef* dirty) {
+    if (dirty) {
+        for (int p = 0; p < HMS_OLED_MAX_PAGES; p++) {
+            dirty->col_start[p] = 0xFFFF;
+            dirty->col_end[p] = 0;
+        }
+    }
+    if (!m_anim_data || !m_buffer) return HMS_OLED_ERROR;
+
+    if (m_anim_frame >= m_anim_frames) {
+        m_anim_pos = HMS_OLED_ANIM_HEADER_SIZE;
+        m_anim_frame = 0;
+    }
+
+    if (m_anim_pos + HMS_OLED_ANIM_FRAME_HEADER_SIZE > m_anim_len) return HMS_OLED_ERROR;
+    const uint8_t* frame = m_anim_data + m_anim_pos;
+    if (frame[0] != HMS_OLED_ANIM_FRAME_KEY && frame[0] != HMS_OLED_ANIM_FRAME_DELTA) return HMS_OLED_ERROR;
+    bool key = (frame[0] == HMS_OLED_ANIM_FRAME_KEY);
+    size_t payload = (size_t)(frame[1] | (frame[2] << 8));
+    if (m_anim_pos + HMS_OLED_ANIM_FRAME_HEADER_SIZE + payload > m_anim_len) return HMS_OLED_ERROR;
+
+    size_t stride = m_stride;
+    int canvas_pages = m_canvas_height / 8;
+    int width = m_anim_width;
+    int pages = (m_anim_height + 7) / 8;
+    uint8_t last_mask = (m_anim_height & 7) ? (uint8_t)((1 << (m_anim_height & 7)) - 1) : 0xFF;
+
+    bool ok = decodePackets(frame + HMS_OLED_ANIM_FRAME_HEADER_SIZE, payload, (size_t)width * pages, key,
+        [&](size_t pos, uint8_t v) {
+            int p = (int)(pos / width);
+            int page = m_anim_page + p;
+            int col = m_anim_x + (int)(pos % width);
+            if (page < 0 || page >= canvas_pages || col < 0 || col >= m_canvas_width) return;
+
+            // Rows below the animation on its last page are left untouched
+            uint8_t m = (p == pages - 1) ? last_mask : 0xFF;
+            uint8_t* dst = &m_buffer[page * stride + col];
+            uint8_t next = key ? (uint8_t)((*dst & ~m) | (v & m)) : (uint8_t)(*dst ^ (v & m));
+            if (next == *dst) return;
+            *dst = next;
+            markDirty(dirty, page, col);
+        });
+    if (!ok) return HMS_OLED_ERROR;
+
+    m_anim_pos += HMS_OLED_ANIM_FRAME_HEADER_SIZE + payload;
+    m_anim_frame++;
+
+    // A one-shot animation ends on its last frame; isAnimationRunning() reports it
+    if (m_anim_frame >= m_anim_frames && !m_anim_loop) stopAnimation();
+    return HMS_OLED_OK;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED::updateAnimation(void) {
+    if (!m_anim_data) return HMS_OLED_ERROR;
+
+    uint32_t now = getTickMs();
+    if (m_anim_frame > 0 && (uint32_t)(now - m_anim_last_ms) < m_anim_interval_ms) return HMS_OLED_BUSY;
+
+    // Keep a steady cadence, but don't try to catch up after a long stall
+    if (m_anim_frame > 0 && (uint32_t)(now - m_anim_last_ms) < 2 * m_anim_interval_ms)
+        m_anim_last_ms += m_anim_interval_ms;
+    else
+        m_anim_last_ms = now;
+
+    HMS_OLED_DirtyTypeDef dirty;
+    HMS_OLED_StatusTypeDef r = decodeAnimationFrame(&dirty);
+    if (r != HMS_OLED_OK) return r;
+    return displayDirty(&dirty);
+}
+
+void HMS_OLED::setAnimationFps(uint8_t fps) {
+    m_anim_interval_ms = fps ? 1000 / fps : 0;
+}
+
+void HMS_OLED::stopAnimation(void) {
+    m_anim_data = nullptr;
+    m_anim_len = 0;
+    m_anim_pos = 0;
+    m_anim_frame = 0;
+}
@@ -0,0 +1,213 @@
+#include "HMS_OLED_Chart.h"
+#include <cstring>
+
+HMS_OLED_Chart::HMS_OLED_Chart() :
+    m_oled(nullptr),
+    m_samples(nullptr),
+    m_col_lo(nullptr),
+    m_col_hi(nullptr),
+    m_x(0),
+    m_y(0),
+    m_w(0),
+    m_h(0),
+    m_series(0),
+    m_per_column(1),
+    m_capacity(0),
+    m_total(0),
+    m_lo(0.0f),
+    m_hi(1.0f),
+    m_autoscale(true)
+{
+}
+
+HMS_OLED_Chart::~HMS_OLED_Chart() {
+    end();
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED_Chart::begin(HMS_OLED* oled, int x, int y, int w, int h, uint8_t series, uint16_t capacity) {
+    end();
+    if (!oled || w <= 0 || h <= 1) return HMS_OLED_ERROR;
+    if (series == 0 || series > HMS_OLED_CHART_MAX_SERIES) return HMS_OLED_ERROR;
+
+    m_per_column = (capacity > w) ? (uint16_t)((capacity + w - 1) / w) : 1;
+    // One extra sample keeps the join into the leftmost column available after it scrolls in
+    m_capacity = (uint32_t)w * m_per_column + 1;
+
+    // Sample rings followed by the per-column min/max used for autoscale
+    size_t bytes = ((size_t)m_capacity * series + 2 * (size_t)w) * sizeof(float);
+    m_samples = (float*) malloc(bytes);
+    if (!m_samples) {
+        HMS_OLED_LOGGER(error, "Failed to allocate chart samples (%d bytes)", (int)bytes);
+        return HMS_OLED_NO_MEM;
+    }
+
+    m_col_lo = m_samples + (size_t)m_capacity * series;
+    m_col_hi = m_col_lo + w;
+
+    m_oled = oled;
+    m_x = x;
+    m_y = y;
+    m_w = w;
+    m_h = h;
+    m_series = series;
+    m_total = 0;
+    m_oled->clearRect(m_x, m_y, m_w, m_h);
+    return HMS_OLED_OK;
+}
+
+void HMS_OLED_Chart::end(void) {
+    if (m_samples) {
+        free(m_samples);
+        m_samples = nullptr;
+        m_col_lo = nullptr;
+        m_col_hi = nullptr;
+    }
+    m_oled = nullptr;
+    m_total = 0;
+}
+
+void HMS_OLED_Chart::setRange(float min, float max) {
+    m_autoscale = false;
+    m_lo = min;
+    m_hi = (max > min) ? max : min + 1.0f;
+    redraw();
+}
+
+void HMS_OLED_Chart::setAutoScale(bool enable) {
+    m_autoscale = enable;
+    if (enable && updateScale(true, nullptr)) redraw();
+}
+
+void HMS_OLED_Chart::clear(void) {
+    m_total = 0;
+    if (m_oled) m_oled->clearRect(m_x, m_y, m_w, m_h);
+}
+
+float HMS_OLED_Chart::sampleAt(uint8_t s, uint32_t index) const {
+    return m_samples[(size_t)s * m_capacity + index % m_capacity];
+}
+
+int HMS_OLED_Chart::valueToY(float v) const {
+    float t = (v - m_lo) / (m_hi - m_lo);
+    int py = (int)(t * (m_h - 1) + 0.5f);
+    if (py < 0) py = 0;
+    if (py > m_h - 1) py = m_h - 1;
+    return m_y + m_h - 1 - py;
+}
+
+// Recomputes the autoscale range; returns true when the plot has to be redrawn
+bool HMS_OLED_Chart::updateScale(bool full_check, const float* values) {
+    if (!m_autoscale || m_total == 0) return false;
+
+    // Mid-column samples can only push the range out, which the new values alone tell us
+    if (!full_check && values && m_total > 1) {
+        bool outside = false;
+        for (uint8_t s = 0; s < m_series; s++) {
+            if (values[s] < m_lo || values[s] > m_hi) outside = true;
+        }
+        if (!outside) return false;
+    }
+
+    uint32_t groups = (m_total + m_per_column - 1) / m_per_column;
+    uint32_t first = (groups > (uint32_t)m_w) ? groups - m_w : 0;
+    float lo = m_col_lo[first % m_w];
+    float hi = m_col_hi[first % m_w];
+    for (uint32_t g = first + 1; g < groups; g++) {
+        if (m_col_lo[g % m_w] < lo) lo = m_col_lo[g % m_w];
+        if (m_col_hi[g % m_w] > hi) hi = m_col_hi[g % m_w];
+    }
+
+    bool outside = lo < m_lo || hi > m_hi;
+    // Only shrink once the data uses less than half of the current range, to avoid redrawing on every column
+    bool shrink = full_check && (hi - lo) * 2.0f < (m_hi - m_lo);
+    if (!outside && !shrink && m_total > 1) return false;
+
+    float pad = (hi - lo) * 0.1f;
+    if (pad <= 0.0f) pad = (lo != 0.0f) ? (lo < 0 ? -lo : lo) * 0.1f : 1.0f;
+    m_lo = lo - pad;
+    m_hi = hi + pad;
+    return true;
+}
+
+void HMS_OLED_Chart::drawColumn(uint32_t group, int col) {
+    m_oled->drawVLine(col, m_y, m_h, false);
+
+    uint32_t start = group * m_per_column;
+    uint32_t stop = start + m_per_column;
+    if (stop > m_total) stop = m_total;
+
+    for (uint8_t s = 0; s < m_series; s++) {
+        float lo = sampleAt(s, start);
+        float hi = lo;
+        for (uint32_t i = start + 1; i < stop; i++) {
+            float v = sampleAt(s, i);
+            if (v < lo) lo = v;
+            if (v > hi) hi = v;
+        }
+
+        // Join to the previous column's last sample so the trace stays continuous
+        if (start > 0) {
+            float prev = sampleAt(s, start - 1);
+            if (prev < lo) lo = prev;
+            if (prev > hi) hi = prev;
+        }
+
+        int top = valueToY(hi);
+        int bottom = valueToY(lo);
+        m_oled->drawVLine(col, top, bottom - top + 1, true);
+    }
+}
+
+void HMS_OLED_Chart::redraw(void) {
+    if (!m_oled) return;
+    m_oled->clearRect(m_x, m_y, m_w, m_h);
+    if (m_total == 0) return;
+
+    uint32_t groups = (m_total + m_per_column - 1) / m_per_column;
+    uint32_t first = (groups > (uint32_t)m_w) ? groups - m_w : 0;
+    for (uint32_t g = first; g < groups; g++) {
+        drawColumn(g, m_x + (int)(g - first));
+    }
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED_Chart::addSample(float value) {
+    // Single-value form is only meaningful for a single-series chart
+    if (m_series != 1) return HMS_OLED_ERROR;
+    return addSample(&value);
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED_Chart::addSample(const float* values) {
+    if (!m_oled || !m_samples || !values) return HMS_OLED_ERROR;
+
+    for (uint8_t s = 0; s < m_series; s++) {
+        m_samples[(size_t)s * m_capacity + m_total % m_capacity] = values[s];
+    }
+    uint32_t index = m_total++;
+    uint32_t group = index / m_per_column;
+    bool new_column = (index % m_per_column) == 0;
+
+    float* col_lo = &m_col_lo[group % m_w];
+    float* col_hi = &m_col_hi[group % m_w];
+    if (new_column) *col_lo = *col_hi = values[0];
+    for (uint8_t s = 0; s < m_series; s++) {
+        if (values[s] < *col_lo) *col_lo = values[s];
+        if (values[s] > *col_hi) *col_hi = values[s];
+    }
+
+    if (updateScale(new_column, values)) {
+        redraw();
+        return HMS_OLED_OK;
+    }
+
+    if (new_column && group >= (uint32_t)m_w) {
+        m_oled->scrollWindowLeft(m_x, m_y, m_w, m_h, 1);
+    }
+    int col = m_x + ((group >= (uint32_t)m_w) ? m_w - 1 : (int)group);
+    drawColumn(group, col);
+    return HMS_OLED_OK;
+}
+
+HMS_OLED_StatusTypeDef HMS_OLED_Chart::display(void) {
+    if (!m_oled) return HMS_OLED_ERROR;
+    return m_oled->displayWindow(m_x, m_y, m_w, m_h);
+}
@@ -0,0 +1,117 @@
+/*
+ ============================================================================================================================================
+ * File:        hms_oled_anim.cpp
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.0.0
+ * Date:        Oct 18 2026
+ * Brief:       This file provides the offline encoder for HMS_OLED key/delta animations.
+ ============================================================================================================================================
+ * License: 
+ * MIT License
+ * 
+ * Copyright (c) 2025 Hamas Saeed
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, 
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do 
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION 
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ ============================================================================================================================================
+ */
+
+#include "hms_oled_tools.h"
+
+static void usage(void) {
+    fprintf(stderr,
+        "usage: hms_oled_anim -o out.h [-n name] [-f fps] [-k keyframe_interval] [-i] frame.pbm...\n"
+        "  -f  target frames per second stored in the header (default 15)\n"
+        "  -k  force a key frame every N frames (default 0 = only the first)\n"
+        "  -i  treat white PBM pixels as lit\n");
+}
+
+int main(int argc, char** argv) {
+    const char* out_path = nullptr;
+    std::string name = "hms_oled_anim";
+    int fps = 15;
+    int key_interval = 0;
+    bool invert = false;
+    std::vector<const char*> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-o" && i + 1 < argc) out_path = argv[++i];
+        else if (a == "-n" && i + 1 < argc) name = argv[++i];
+        else if (a == "-f" && i + 1 < argc) fps = atoi(argv[++i]);
+        else if (a == "-k" && i + 1 < argc) key_interval = atoi(argv[++i]);
+        else if (a == "-i") invert = true;
+        else if (!a.empty() && a[0] == '-') { usage(); return 1; }
+        else inputs.push_back(argv[i]);
+    }
+    if (!out_path || inputs.empty() || fps < 0 || fps > 255 || inputs.size() > 0xFFFF) {
+        usage();
+        return 1;
+    }
+
+    std::vector<uint8_t> blob;
+    std::vector<uint8_t> prev;
+    HMS_OLED_ToolImage first;
+
+    for (size_t n = 0; n < inputs.size(); n++) {
+        HMS_OLED_ToolImage img;
+        if (!loadPbm(inputs[n], invert, img)) return 1;
+
+        if (n == 0) {
+            first = img;
+            if (img.width > 0xFFFF || img.height > 0xFFFF) {
+                fprintf(stderr, "%s: frame too large\n", inputs[n]);
+                return 1;
+            }
+            blob.push_back(HMS_OLED_ANIM_MAGIC_0);
+            blob.push_back(HMS_OLED_ANIM_MAGIC_1);
+            putU16(blob, img.width);
+            putU16(blob, img.height);
+            blob.push_back((uint8_t)fps);
+            putU16(blob, (unsigned)inputs.size());
+        } else if (img.width != first.width || img.height != first.height) {
+            fprintf(stderr, "%s: size differs from first frame\n", inputs[n]);
+            return 1;
+        }
+
+        std::vector<uint8_t> key;
+        encodePackets(img.data.data(), img.data.size(), key);
+
+        // Delta against the previous frame, used only when it beats the key frame
+        std::vector<uint8_t> delta;
+        bool force_key = (n == 0) || (key_interval > 0 && n % key_interval == 0);
+        if (!force_key) {
+            std::vector<uint8_t> x(img.data.size());
+            for (size_t i = 0; i < x.size(); i++) x[i] = img.data[i] ^ prev[i];
+            encodePackets(x.data(), x.size(), delta);
+        }
+
+        bool use_key = force_key || key.size() <= delta.size();
+        const std::vector<uint8_t>& payload = use_key ? key : delta;
+        if (payload.size() > 0xFFFF) {
+            fprintf(stderr, "%s: frame payload too large\n", inputs[n]);
+            return 1;
+        }
+        blob.push_back(use_key ? HMS_OLED_ANIM_FRAME_KEY : HMS_OLED_ANIM_FRAME_DELTA);
+        putU16(blob, (unsigned)payload.size());
+        blob.insert(blob.end(), payload.begin(), payload.end());
+
+        prev = img.data;
+    }
+
+    if (!writeCArray(out_path, name, blob)) return 1;
+    printf("%s: %u frames, %dx%d, %u bytes (raw %u)\n", out_path, (unsigned)inputs.size(), first.width, first.height,
+           (unsigned)blob.size(), (unsigned)(inputs.size() * first.data.size()));
+    return 0;
+}
@@ -0,0 +1,107 @@
+/*
+ ============================================================================================================================================
+ * File:        hms_oled_assetpack.cpp
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.0.0
+ * Date:        Oct 18 2026
+ * Brief:       This file provides the build-time packer for HMS_OLED compressed asset packs.
+ ============================================================================================================================================
+ * License: 
+ * MIT License
+ * 
+ * Copyright (c) 2025 Hamas Saeed
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, 
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do 
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION 
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ ============================================================================================================================================
+ */
+
+#include "hms_oled_tools.h"
+
+static void usage(void) {
+    fprintf(stderr,
+        "usage: hms_oled_assetpack -o out.h [-n name] [-i] asset.pbm...\n"
+        "  asset ids follow argument order and are emitted as NAME_<FILE> enum values\n"
+        "  -i  treat white PBM pixels as lit\n");
+}
+
+// "icons/wifi-on.pbm" -> "WIFI_ON"
+static std::string assetSymbol(const char* path) {
+    std::string s = path;
+    size_t slash = s.find_last_of("/\\");
+    if (slash != std::string::npos) s = s.substr(slash + 1);
+    size_t dot = s.find_last_of('.');
+    if (dot != std::string::npos) s = s.substr(0, dot);
+    for (char& c : s) c = isalnum((unsigned char)c) ? (char)toupper((unsigned char)c) : '_';
+    return s;
+}
+
+int main(int argc, char** argv) {
+    const char* out_path = nullptr;
+    std::string name = "hms_oled_assets";
+    bool invert = false;
+    std::vector<const char*> inputs;
+
+    for (int i = 1; i < argc; i++) {
+        std::string a = argv[i];
+        if (a == "-o" && i + 1 < argc) out_path = argv[++i];
+        else if (a == "-n" && i + 1 < argc) name = argv[++i];
+        else if (a == "-i") invert = true;
+        else if (!a.empty() && a[0] == '-') { usage(); return 1; }
+        else inputs.push_back(argv[i]);
+    }
+    if (!out_path || inputs.empty() || inputs.size() > 0xFFFF) {
+        usage();
+        return 1;
+    }
+
+    size_t count = inputs.size();
+    std::vector<uint8_t> index;
+    std::vector<uint8_t> data;
+    size_t raw = 0;
+
+    std::string prefix = name;
+    for (char& c : prefix) c = (char)toupper((unsigned char)c);
+    std::string ids = "enum {\n";
+
+    for (size_t n = 0; n < count; n++) {
+        HMS_OLED_ToolImage img;
+        if (!loadPbm(inputs[n], invert, img)) return 1;
+        if (img.width > 0xFFFF || img.height > 0xFFFF) {
+            fprintf(stderr, "%s: asset too large\n", inputs[n]);
+            return 1;
+        }
+
+        size_t offset = HMS_OLED_PACK_HEADER_SIZE + count * HMS_OLED_PACK_ENTRY_SIZE + data.size();
+        putU32(index, (unsigned long)offset);
+        putU16(index, (unsigned)img.width);
+        putU16(index, (unsigned)img.height);
+        encodePackets(img.data.data(), img.data.size(), data);
+        raw += img.data.size();
+
+        ids += "    " + prefix + "_" + assetSymbol(inputs[n]) + " = " + std::to_string(n) + ",\n";
+    }
+    ids += "    " + prefix + "_COUNT = " + std::to_string(count) + "\n};\n";
+
+    std::vector<uint8_t> blob;
+    blob.push_back(HMS_OLED_PACK_MAGIC_0);
+    blob.push_back(HMS_OLED_PACK_MAGIC_1);
+    putU16(blob, (unsigned)count);
+    blob.insert(blob.end(), index.begin(), index.end());
+    blob.insert(blob.end(), data.begin(), data.end());
+
+    if (!writeCArray(out_path, name, blob, ids)) return 1;
+    printf("%s: %u assets, %u bytes (raw %u)\n", out_path, (unsigned)count, (unsigned)blob.size(), (unsigned)raw);
+    return 0;
+}
@@ -0,0 +1,197 @@
+/*
+ ============================================================================================================================================
+ * File:        hms_oled_tools.h
+ * Author:      Hamas Saeed
+ * Version:     Rev_1.0.0
+ * Date:        Oct 18 2026
+ * Brief:       This file provides shared helpers for the HMS_OLED host-side asset tools.
+ ============================================================================================================================================
+ * License: 
+ * MIT License
+ * 
+ * Copyright (c) 2025 Hamas Saeed
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files
+ * (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, 
+ * publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do 
+ * so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE 
+ * FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION 
+ * WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ * 
+ * For any inquiries, contact Hamas Saeed at hamasaeed@gmail.com
+ ============================================================================================================================================
+ */
+
+#ifndef HMS_OLED_TOOLS_H
+#define HMS_OLED_TOOLS_H
+
+#include "HMS_OLED_Config.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+/*
+  ┌─────────────────────────────────────────────────────────────────────┐
+  │ Note: 1bpp image in page format (w columns x pages rows of bytes)   │
+  └─────────────────────────────────────────────────────────────────────┘
+*/
+struct HMS_OLED_ToolImage {
+    int width = 0;
+    int height = 0;
+    int pages = 0;
+    std::vector<uint8_t> data;
+};
+
+static inline int pbmNextToken(FILE* f) {
+    int c = fgetc(f);
+    while (c != EOF) {
+        if (c == '#') {
+            while (c != EOF && c != '\n') c = fgetc(f);
+        } else if (!isspace(c)) {
+            return c;
+        }
+        c = fgetc(f);
+    }
+    return EOF;
+}
+
+static inline int pbmReadInt(FILE* f) {
+    int c = pbmNextToken(f);
+    int v = 0;
+    while (c != EOF && isdigit(c)) {
+        v = v * 10 + (c - '0');
+        c = fgetc(f);
+    }
+    return v;
+}
+
+// Loads a P1/P4 PBM; set (black) pixels become lit pixels unless invert is given
+static inline bool loadPbm(const char* path, bool invert, HMS_OLED_ToolImage& img) {
+    FILE* f = fopen(path, "rb");
+    if (!f) {
+        fprintf(stderr, "%s: cannot open\n", path);
+        return false;
+    }
+
+    int m0 = fgetc(f);
+    int m1 = fgetc(f);
+    if (m0 != 'P' || (m1 != '1' && m1 != '4')) {
+        fprintf(stderr, "%s: not a PBM (P1/P4) file\n", path);
+        fclose(f);
+        return false;
+    }
+
+    img.width = pbmReadInt(f);
+    img.height = pbmReadInt(f);
+    if (img.width <= 0 || img.height <= 0) {
+        fprintf(stderr, "%s: bad dimensions\n", path);
+        fclose(f);
+        return false;
+    }
+    img.pages = (img.height + 7) / 8;
+    img.data.assign((size_t)img.width * img.pages, 0);
+
+    int row_bytes = (img.width + 7) / 8;
+    std::vector<uint8_t> row(row_bytes);
+    for (int y = 0; y < img.height; y++) {
+        if (m1 == '4') {
+            if (fread(row.data(), 1, row_bytes, f) != (size_t)row_bytes) {
+                fprintf(stderr, "%s: truncated\n", path);
+                fclose(f);
+                return false;
+            }
+        }
+        for (int x = 0; x < img.width; x++) {
+            bool on;
+            if (m1 == '4') {
+                on = row[x / 8] & (0x80 >> (x % 8));
+            } else {
+                int c = pbmNextToken(f);
+                if (c != '0' && c != '1') {
+                    fprintf(stderr, "%s: truncated\n", path);
+                    fclose(f);
+                    return false;
+                }
+                on = (c == '1');
+            }
+            if (on != invert) img.data[(y / 8) * img.width + x] |= (uint8_t)(1 << (y & 7));
+        }
+    }
+    fclose(f);
+    return true;
+}
+
+// Packs page-format bytes into the skip/run/literal stream decoded by HMS_OLED
+static inline void encodePackets(const uint8_t* in, size_t n, std::vector<uint8_t>& out) {
+    size_t i = 0;
+    while (i < n) {
+        size_t z = 0;
+        while (i + z < n && in[i + z] == 0 && z < HMS_OLED_PACKET_MAX_SKIP) z++;
+        if (z) {
+            out.push_back((uint8_t)(HMS_OLED_PACKET_SKIP | (z - 1)));
+            i += z;
+            continue;
+        }
+
+        size_t r = 1;
+        while (i + r < n && in[i + r] == in[i] && r < HMS_OLED_PACKET_MAX_RUN) r++;
+        if (r >= 3) {
+            out.push_back((uint8_t)(HMS_OLED_PACKET_RUN | (r - 1)));
+            out.push_back(in[i]);
+            i += r;
+            continue;
+        }
+
+        // Literal until a zero pair or a run of three starts
+        size_t l = 1;
+        while (i + l < n && l < HMS_OLED_PACKET_MAX_LITERAL) {
+            const uint8_t* p = in + i + l;
+            size_t left = n - i - l;
+            if (p[0] == 0 && (left == 1 || p[1] == 0)) break;
+            if (left >= 3 && p[0] == p[1] && p[0] == p[2]) break;
+            l++;
+        }
+        out.push_back((uint8_t)(HMS_OLED_PACKET_LITERAL | (l - 1)));
+        out.insert(out.end(), in + i, in + i + l);
+        i += l;
+    }
+}
+
+static inline void putU16(std::vector<uint8_t>& out, unsigned v) {
+    out.push_back((uint8_t)(v & 0xFF));
+    out.push_back((uint8_t)(v >> 8));
+}
+
+static inline void putU32(std::vector<uint8_t>& out, unsigned long v) {
+    for (int i = 0; i < 4; i++) out.push_back((uint8_t)((v >> (8 * i)) & 0xFF));
+}
+
+// Writes the blob as a C header with `name` and `name_len`
+static inline bool writeCArray(const char* path, const std::string& name, const std::vector<uint8_t>& blob, const std::string& extra = "") {
+    FILE* f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "%s: cannot write\n", path);
+        return false;
+    }
+
+    fprintf(f, "// Generated by HMS_OLED tools - do not edit\n");
+    fprintf(f, "#pragma once\n\n#include <stddef.h>\n#include <stdint.h>\n\n");
+    if (!extra.empty()) fprintf(f, "%s\n", extra.c_str());
+    fprintf(f, "static const uint8_t %s[%u] = {", name.c_str(), (unsigned)blob.size());
+    for (size_t i = 0; i < blob.size(); i++) {
+        fprintf(f, "%s0x%02x%s", (i % 16) ? " " : "\n    ", blob[i], (i + 1 < blob.size()) ? "," : "");
+    }
+    fprintf(f, "\n};\n\nstatic const size_t %s_len = sizeof(%s);\n", name.c_str(), name.c_str());
+    fclose(f);
+    return true;
+}
+
+#endif // HMS_OLED_TOOLS_H